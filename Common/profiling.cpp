@@ -0,0 +1,172 @@
+#include "profiling.h"
+
+#ifdef DSA_PROFILE
+
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace prof {
+
+namespace {
+
+// Registry of operation names and per-thread shards. The mutex is only taken
+// when a new name or thread shows up and while dumping, never per call.
+struct Registry {
+    std::mutex mutex;
+    const char* names[kMaxOps] = {};
+    int numOps = 0;
+    std::vector<std::unique_ptr<Shard>> shards;
+};
+
+Registry& registry() {
+    static Registry* r = new Registry(); // Never destroyed so late dumps stay safe
+    return *r;
+}
+
+// Plain (non-atomic) totals for one operation, summed over all shards
+struct Totals {
+    std::uint64_t calls = 0;
+    std::uint64_t totalTicks = 0;
+    std::uint64_t maxTicks = 0;
+    std::uint64_t allocs = 0;
+    std::uint64_t buckets[kBuckets] = {};
+};
+
+const char* tickUnit() {
+#ifdef DSA_PROFILE_USE_TSC
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+// Snapshot every registered operation; returns the number of operations
+int collect(Registry& r, Totals (&totals)[kMaxOps], const char* (&names)[kMaxOps]) {
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (int i = 0; i < r.numOps; ++i) names[i] = r.names[i];
+    for (const auto& shard : r.shards) {
+        for (int i = 0; i < r.numOps; ++i) {
+            const OpStats& op = shard->ops[i];
+            Totals& t = totals[i];
+            t.calls += op.calls.load(std::memory_order_relaxed);
+            t.totalTicks += op.totalTicks.load(std::memory_order_relaxed);
+            t.allocs += op.allocs.load(std::memory_order_relaxed);
+            std::uint64_t m = op.maxTicks.load(std::memory_order_relaxed);
+            if (m > t.maxTicks) t.maxTicks = m;
+            for (int b = 0; b < kBuckets; ++b) t.buckets[b] += op.buckets[b].load(std::memory_order_relaxed);
+        }
+    }
+    return r.numOps;
+}
+
+} // namespace
+
+int registerOp(const char* name) {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (int i = 0; i < r.numOps; ++i) {
+        if (std::strcmp(r.names[i], name) == 0) return i; // Same name used in several places
+    }
+    if (r.numOps == kMaxOps) return -1; // Table full, calls are timed but not recorded
+    r.names[r.numOps] = name;
+    return r.numOps++;
+}
+
+Shard* registerShard() {
+    Registry& r = registry();
+    auto shard = std::make_unique<Shard>();
+    Shard* raw = shard.get();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.shards.push_back(std::move(shard));
+    return raw;
+}
+
+void dumpJson(std::ostream& out) {
+    Totals totals[kMaxOps];
+    const char* names[kMaxOps] = {};
+    int n = collect(registry(), totals, names);
+
+    out << "{\"unit\":\"" << tickUnit() << "\",\"ops\":{";
+    for (int i = 0; i < n; ++i) {
+        const Totals& t = totals[i];
+        if (i > 0) out << ",";
+        out << "\"" << names[i] << "\":{"
+            << "\"calls\":" << t.calls
+            << ",\"total\":" << t.totalTicks
+            << ",\"max\":" << t.maxTicks
+            << ",\"allocs\":" << t.allocs
+            << ",\"histogram\":[";
+        // Only non-empty buckets; "le" is the bucket's upper bound (null = overflow)
+        bool first = true;
+        for (int b = 0; b < kBuckets; ++b) {
+            if (t.buckets[b] == 0) continue;
+            if (!first) out << ",";
+            out << "{\"le\":";
+            if (b == kBuckets - 1) out << "null";
+            else out << (std::uint64_t(1) << b);
+            out << ",\"count\":" << t.buckets[b] << "}";
+            first = false;
+        }
+        out << "]}";
+    }
+    out << "}}\n";
+}
+
+void dumpPrometheus(std::ostream& out) {
+    Totals totals[kMaxOps];
+    const char* names[kMaxOps] = {};
+    int n = collect(registry(), totals, names);
+    const char* unit = tickUnit();
+
+    out << "# TYPE dsa_op_calls_total counter\n";
+    for (int i = 0; i < n; ++i) {
+        out << "dsa_op_calls_total{op=\"" << names[i] << "\"} " << totals[i].calls << "\n";
+    }
+    out << "# TYPE dsa_op_allocations_total counter\n";
+    for (int i = 0; i < n; ++i) {
+        out << "dsa_op_allocations_total{op=\"" << names[i] << "\"} " << totals[i].allocs << "\n";
+    }
+    out << "# TYPE dsa_op_latency_max_" << unit << " gauge\n";
+    for (int i = 0; i < n; ++i) {
+        out << "dsa_op_latency_max_" << unit << "{op=\"" << names[i] << "\"} " << totals[i].maxTicks << "\n";
+    }
+    out << "# TYPE dsa_op_latency_" << unit << " histogram\n";
+    for (int i = 0; i < n; ++i) {
+        const Totals& t = totals[i];
+        std::uint64_t cumulative = 0;
+        for (int b = 0; b < kBuckets - 1; ++b) {
+            cumulative += t.buckets[b];
+            out << "dsa_op_latency_" << unit << "_bucket{op=\"" << names[i] << "\",le=\""
+                << (std::uint64_t(1) << b) << "\"} " << cumulative << "\n";
+        }
+        out << "dsa_op_latency_" << unit << "_bucket{op=\"" << names[i] << "\",le=\"+Inf\"} " << t.calls << "\n";
+        out << "dsa_op_latency_" << unit << "_sum{op=\"" << names[i] << "\"} " << t.totalTicks << "\n";
+        out << "dsa_op_latency_" << unit << "_count{op=\"" << names[i] << "\"} " << t.calls << "\n";
+    }
+}
+
+} // namespace prof
+
+// Count heap allocations per thread. The aligned overloads are left alone;
+// none of the projects allocate over-aligned types.
+void* operator new(std::size_t size) {
+    ++prof::t_allocs;
+    if (size == 0) size = 1;
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+#endif // DSA_PROFILE
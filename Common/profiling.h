@@ -0,0 +1,145 @@
+#ifndef PROFILING_H
+#define PROFILING_H
+
+// Lightweight runtime instrumentation shared by the three projects.
+//
+// Compile with -DDSA_PROFILE (and add Common/profiling.cpp to the build) to
+// collect, per named operation: call counts, a log2 latency histogram and the
+// number of heap allocations made while the operation was running.
+// Add -DDSA_PROFILE_RDTSC on x86-64 to time with the TSC (cycles) instead of
+// std::chrono::steady_clock (nanoseconds).
+//
+// Without DSA_PROFILE, PROF_SCOPE expands to nothing and the dump functions
+// are empty inline stubs, so instrumented code costs nothing.
+
+#include <ostream>
+
+#ifdef DSA_PROFILE
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(DSA_PROFILE_RDTSC) && (defined(__x86_64__) || defined(_M_X64))
+#define DSA_PROFILE_USE_TSC 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace prof {
+
+constexpr int kMaxOps = 32;   // Distinct operation names we can track
+constexpr int kBuckets = 32;  // Bucket i holds latencies in [2^(i-1), 2^i); last bucket is overflow
+
+// Counters for one operation. Only the owning thread writes them, so plain
+// relaxed load+store is enough (no locked instructions on the hot path).
+struct OpStats {
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> totalTicks{0};
+    std::atomic<std::uint64_t> maxTicks{0};
+    std::atomic<std::uint64_t> allocs{0};
+    std::atomic<std::uint64_t> buckets[kBuckets] = {};
+};
+
+// One shard per thread; shards are owned by a global registry and outlive
+// their thread so that nothing is lost when a worker exits.
+struct Shard {
+    OpStats ops[kMaxOps];
+};
+
+// Heap allocations made by the current thread (bumped by operator new in profiling.cpp)
+inline thread_local std::uint64_t t_allocs = 0;
+
+// Returns a stable id for an operation name, or -1 if the table is full
+int registerOp(const char* name);
+
+// Creates and registers the calling thread's shard
+Shard* registerShard();
+
+inline Shard& localShard() {
+    thread_local Shard* shard = nullptr;
+    if (shard == nullptr) shard = registerShard();
+    return *shard;
+}
+
+inline std::uint64_t nowTicks() {
+#ifdef DSA_PROFILE_USE_TSC
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+inline int bucketFor(std::uint64_t ticks) {
+    if (ticks == 0) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+    int width = 64 - __builtin_clzll(ticks);
+#else
+    int width = 0;
+    while (ticks != 0) { ticks >>= 1; ++width; }
+#endif
+    return width < kBuckets ? width : kBuckets - 1;
+}
+
+inline void bump(std::atomic<std::uint64_t>& counter, std::uint64_t by) {
+    counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+}
+
+// RAII timer: records one call of operation `id` when it goes out of scope
+class ScopedTimer {
+public:
+    explicit ScopedTimer(int id) : id_(id), allocsAtStart_(t_allocs), start_(nowTicks()) {}
+
+    ~ScopedTimer() {
+        std::uint64_t elapsed = nowTicks() - start_;
+        std::uint64_t allocs = t_allocs - allocsAtStart_; // Before localShard(), which allocates on first use
+        if (id_ < 0) return;
+        OpStats& op = localShard().ops[id_];
+        bump(op.calls, 1);
+        bump(op.totalTicks, elapsed);
+        bump(op.allocs, allocs);
+        bump(op.buckets[bucketFor(elapsed)], 1);
+        if (elapsed > op.maxTicks.load(std::memory_order_relaxed)) {
+            op.maxTicks.store(elapsed, std::memory_order_relaxed);
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    int id_;
+    std::uint64_t allocsAtStart_;
+    std::uint64_t start_;
+};
+
+// Merge all thread shards and write them out
+void dumpJson(std::ostream& out);
+void dumpPrometheus(std::ostream& out);
+
+} // namespace prof
+
+#define PROF_CONCAT_INNER(a, b) a##b
+#define PROF_CONCAT(a, b) PROF_CONCAT_INNER(a, b)
+
+// Time the rest of the enclosing scope under the given operation name
+#define PROF_SCOPE(name)                                                              \
+    static const int PROF_CONCAT(prof_id_, __LINE__) = ::prof::registerOp(name);     \
+    ::prof::ScopedTimer PROF_CONCAT(prof_timer_, __LINE__)(PROF_CONCAT(prof_id_, __LINE__))
+
+#else // !DSA_PROFILE
+
+namespace prof {
+inline void dumpJson(std::ostream&) {}
+inline void dumpPrometheus(std::ostream&) {}
+} // namespace prof
+
+#define PROF_SCOPE(name) ((void)0)
+
+#endif // DSA_PROFILE
+
+#endif // PROFILING_H
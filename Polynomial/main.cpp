@@ -1,5 +1,6 @@
 #include <iostream>
 #include "Polynomial.h"
+#include "../Common/profiling.h"
 
 int main() {
     Polynomial p1;
@@ -31,5 +32,6 @@ int main() {
     z.insertTerm(-1, 1);
     std::cout << "zero (should be 0): " << z.toString() << std::endl;
 
+    prof::dumpJson(std::cerr); // No-op unless built with -DDSA_PROFILE
     return 0;
 }
@@ -1,4 +1,5 @@
 #include "Polynomial.h"
+#include "../Common/profiling.h"
 #include <sstream>
 #include <cmath>
 
@@ -80,6 +81,7 @@ std::string Polynomial::toString() const {
 
 // Add two polynomials together
 Polynomial Polynomial::add(const Polynomial& other) const {
+    PROF_SCOPE("polynomial.add");
     Polynomial result_poly = *this; // Start with a copy of current polynomial
 
     // Add all terms from the other polynomial
@@ -94,6 +96,7 @@ Polynomial Polynomial::add(const Polynomial& other) const {
 
 // Multiply two polynomials
 Polynomial Polynomial::multiply(const Polynomial& other) const {
+    PROF_SCOPE("polynomial.multiply");
     Polynomial result_poly;
     
     // Multiply each term in this polynomial with each term in other polynomial
@@ -115,6 +118,7 @@ Polynomial Polynomial::multiply(const Polynomial& other) const {
 
 // Calculate derivative of polynomial
 Polynomial Polynomial::derivative() const {
+    PROF_SCOPE("polynomial.derivative");
     Polynomial derivative_result;
     
     for (const auto& term : terms_) {
@@ -1,4 +1,5 @@
 #include "TextEditor.h"
+#include "../Common/profiling.h"
 
 #include <deque>
 #include <string>
@@ -13,11 +14,13 @@ public:
     ~ConcreteTextEditor() override = default;
 
     void insertChar(char character) override {
+        PROF_SCOPE("texteditor.insertChar");
         // Just add the character to the left side (before cursor)
         leftSide_.push_back(character);
     }
 
     void deleteChar() override {
+        PROF_SCOPE("texteditor.deleteChar");
         // Only delete if there's something to delete on the left
         if (!leftSide_.empty()) {
             leftSide_.pop_back();
@@ -25,6 +28,7 @@ public:
     }
 
     void moveLeft() override {
+        PROF_SCOPE("texteditor.moveLeft");
         // Move cursor left by transferring character from left to right
         if (!leftSide_.empty()) {
             char ch = leftSide_.back();
@@ -34,6 +38,7 @@ public:
     }
 
     void moveRight() override {
+        PROF_SCOPE("texteditor.moveRight");
         // Move cursor right by transferring character from right to left  
         if (!rightSide_.empty()) {
             char ch = rightSide_.front();
@@ -43,6 +48,7 @@ public:
     }
 
     std::string getTextWithCursor() const override {
+        PROF_SCOPE("texteditor.getTextWithCursor");
         std::string result;
         
         // Pre-allocate space for efficiency (though probably not necessary for most cases)
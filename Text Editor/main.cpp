@@ -1,6 +1,7 @@
 // main.cpp - test driver
 #include <iostream>
 #include "TextEditor.h"
+#include "../Common/profiling.h"
 
 int main() {
     auto ed = createTextEditor();
@@ -27,5 +28,6 @@ int main() {
     ed->moveRight();
     std::cout << "After move right twice: " << ed->getTextWithCursor() << std::endl;
 
+    prof::dumpJson(std::cerr); // No-op unless built with -DDSA_PROFILE
     return 0;
 }
@@ -1,5 +1,6 @@
 #include <iostream>
 #include "UNO.h"
+#include "../Common/profiling.h"
 
 int main() {
     UNOGame game(2);
@@ -11,5 +12,6 @@ int main() {
     std::cout << game.getState() << std::endl;
     game.playTurn();
     std::cout << game.getState() << std::endl;
+    prof::dumpJson(std::cerr); // No-op unless built with -DDSA_PROFILE
     return 0;
 }
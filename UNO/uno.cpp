@@ -1,4 +1,5 @@
 #include "UNO.h"
+#include "../Common/profiling.h"
 #include <random>
 #include <algorithm>
 #include <sstream>
@@ -168,6 +169,7 @@ UNOGame::UNOGame(int numPlayers) {
 
 // Function to initialize the game
 void UNOGame::initialize() {
+    PROF_SCOPE("uno.initialize"); // Time dealing and shuffling
     UNOGameData& d = dataFor(this); // Access game data
     d.hands.assign(d.numPlayers, {}); // Clear player hands
     d.discard.clear(); // Clear discard pile
@@ -195,6 +197,7 @@ void UNOGame::initialize() {
 
 // Function to play a turn in the game
 void UNOGame::playTurn() {
+    PROF_SCOPE("uno.playTurn"); // Time the whole turn, including draws
     UNOGameData& d = dataFor(this); // Access game data
     if (d.winner != -1) return; // Check if game is already won
     if (d.discard.empty()) { d.winner = -2; return; } // No cards in discard pile